@@ -12,9 +12,11 @@
 #include <sstream>
 #include <cmath>
 #include <set>
+#include <fstream>
+#include <cstdlib>
 
 /// @brief Current version of TinyTest. Follows [Semantic Versioning](https://semver.org/).
-#define TINYTEST_VERSION "1.21.5"
+#define TINYTEST_VERSION "1.22.0"
 
 #ifndef TINYTEST_ASSERTION_FAILED_TO_STDERR
 /// @brief When an assertion fails, some output gets generated and sent to stderr. Setting this constant to 0 disables this behaviour.
@@ -59,6 +61,18 @@
 #define TINYTEST_FLAKY_TEST_ITERATIONS 10
 #endif
 
+#ifndef TINYTEST_RESULTS_FILE_ENV
+/**
+ * @brief Name of the environment variable that, when set, holds the path of a file where machine-readable results get appended.
+ *  One line per test case, written whatever the verbosity flags are. Used by the TinyTest runner.
+ *  Format : `case<TAB>passed assertions<TAB>total assertions<TAB>name` for test cases,
+ *  `flaky<TAB>passed runs<TAB>failed runs<TAB>skipped runs<TAB>name` for flaky test cases,
+ *  and `abort<TAB>passed assertions<TAB>total assertions<TAB>name` for a test case stopped by a failed assertion
+ *  (see TINYTEST_ASSERTION_FAILED_STOPS_EXECUTION).
+ */
+#define TINYTEST_RESULTS_FILE_ENV "TINYTEST_RESULTS_FILE"
+#endif
+
 #ifndef TINYTEST_SETUP_FUNCTION
 /**
  * @brief A macro that will be run at the start of every test case, at the beginning of the test scope.
@@ -120,6 +134,18 @@
 #define _assert_condition_passed(condition) \
             TINYTEST_TESTS_PASSED_COUNT++; \
             test_passed(); 
+/// @brief Makes a test case name fit on a single results line. Internal use only.
+#define _results_name(name) [](std::string tinytest_name) { \
+    for (char& c : tinytest_name) if (c == '\t' || c == '\n' || c == '\r') c = ' '; \
+    return tinytest_name; \
+}(name)
+/// @brief Stops execution after a failed assertion, reporting the test case as aborted in the results file first. Internal use only.
+#define _stop_execution() { \
+    if (TINYTEST_RESULTS_STREAM.is_open()) \
+        TINYTEST_RESULTS_STREAM << "abort\t" << TINYTEST_TESTS_PASSED_COUNT << "\t" << TINYTEST_ASSERTIONS_COUNT << "\t" \
+            << _results_name(TINYTEST_TEST_CASE_NAME.str()) << std::endl; \
+    std::terminate(); \
+}
 #define tinytest_deprecated(old_function_name, new_function_name) [[deprecated]]; \
     test_warning_important(old_function_name << "() (line " << __LINE__ << ") is deprecated, in favor of " << old_function_name << "().")
 /** @endcond */
@@ -134,7 +160,7 @@
         if (!(condition)) { \
             _assert_condition_failed(condition, additional_message_on_failure) \
             if (TINYTEST_ASSERTION_FAILED_STOPS_EXECUTION) \
-                std::terminate(); \
+                _stop_execution(); \
         } else { \
             _assert_condition_passed(condition) \
         } \
@@ -178,7 +204,7 @@
         } else { \
             _assert_condition_failed(expression, message_on_failure << "\n"); \
             if (TINYTEST_ASSERTION_FAILED_STOPS_EXECUTION) \
-                std::terminate(); \
+                _stop_execution(); \
         } \
     }
 
@@ -263,6 +289,8 @@
 #define _base_test_case(test_case_header, ...) [&](){ \
     __VA_ARGS__ \
     test_header(test_case_header); \
+    std::ostringstream TINYTEST_TEST_CASE_NAME; \
+    TINYTEST_TEST_CASE_NAME << test_case_header; \
     int TINYTEST_ASSERTIONS_COUNT = 0; \
     int TINYTEST_TESTS_PASSED_COUNT = 0; \
     std::vector<std::chrono::_V2::system_clock::time_point> TINYTEST_BENCHMARK_VECTORS; \
@@ -309,6 +337,9 @@
          TINYTEST_TESTS_PASSED_COUNT << "/" << TINYTEST_ASSERTIONS_COUNT << \
         COLOR_GRAY << " tests passed." << COLOR_RESET \
     ); \
+    if (TINYTEST_RESULTS_STREAM.is_open() && TINYTEST_REPORT_TEST_CASE) \
+        TINYTEST_RESULTS_STREAM << "case\t" << TINYTEST_TESTS_PASSED_COUNT << "\t" << TINYTEST_ASSERTIONS_COUNT << "\t" \
+            << _results_name(TINYTEST_TEST_CASE_NAME.str()) << std::endl; \
     return (TINYTEST_TESTS_PASSED_COUNT == TINYTEST_ASSERTIONS_COUNT) ? TINYTEST_PASS : TINYTEST_FAIL ; \
     }()
 /**
@@ -330,6 +361,10 @@
         static int TINYTEST_FLAKY_TEST_FAILS  = 0; \
         static int TINYTEST_FLAKY_TEST_SKIPS  = 0; \
         static int TINYTEST_FLAKY_TEST_TOTAL_ITERATIONS = test_case_iterations; \
+        std::ostringstream TINYTEST_FLAKY_TEST_NAME; \
+        TINYTEST_FLAKY_TEST_NAME << test_case_header; \
+        /* Shadows the global one : the iterations get reported once, as a whole, by end_flaky_test_case() */ \
+        const bool TINYTEST_REPORT_TEST_CASE = false; \
         for (int TINYTEST_FLAKY_TEST_ITERATION = 0; TINYTEST_FLAKY_TEST_ITERATION < test_case_iterations; TINYTEST_FLAKY_TEST_ITERATION++) { \
             int TINYTEST_CURRENT_FLAKY_TEST_RESULT = new_test_case("Flaky Test Run " << TINYTEST_FLAKY_TEST_ITERATION + 1, __VA_ARGS__)
 
@@ -352,6 +387,9 @@
         COLOR_GRAY << ", Failed: " << COLOR_RED << TINYTEST_FLAKY_TEST_FAILS << "/" << TINYTEST_FLAKY_TEST_TOTAL_ITERATIONS << \
         COLOR_GRAY << ", Skipped: " << TINYTEST_FLAKY_TEST_SKIPS << "/" << TINYTEST_FLAKY_TEST_TOTAL_ITERATIONS << \
     COLOR_RESET); \
+    if (TINYTEST_RESULTS_STREAM.is_open()) \
+        TINYTEST_RESULTS_STREAM << "flaky\t" << TINYTEST_FLAKY_TEST_PASSES << "\t" << TINYTEST_FLAKY_TEST_FAILS << "\t" \
+            << TINYTEST_FLAKY_TEST_SKIPS << "\t" << _results_name(TINYTEST_FLAKY_TEST_NAME.str()) << std::endl; \
     }\
 }
 
@@ -384,6 +422,9 @@
     bool TINYTEST_FLAG_IMPORTANT_ONLY = false; \
     std::string TINYTEST_CURRENT_TAG = ""; \
     std::unordered_set<std::string> TINYTEST_ENABLED_USER_FLAGS = {};\
+    std::ofstream TINYTEST_RESULTS_STREAM; \
+    if (const char* tinytest_results_file = std::getenv(TINYTEST_RESULTS_FILE_ENV)) \
+        TINYTEST_RESULTS_STREAM.open(tinytest_results_file, std::ios::app); \
     for (int i = 1; i < argc; i++) { \
         if (strcmp(argv[i], "silent") == 0 || strcmp(argv[i], "quiet") == 0 || strcmp(argv[i], "-q") == 0) { \
             TINYTEST_FLAG_VERBOSE = false; \
@@ -471,6 +512,7 @@
  * @warning This is by all means a `main` function. Make sure there is no other main function in your program.
  */
 #define new_test() static bool TINYTEST_ALL_TESTS_PASSED = true; \
+    static const bool TINYTEST_REPORT_TEST_CASE = true; \
     static std::set<std::string> TINYTEST_AVAILABLE_FLAGS = {}; \
     static std::set<std::string> TINYTEST_AVAILABLE_TAGS = {}; \
     int main(int argc, char** argv)
@@ -0,0 +1,569 @@
+/**
+ * @file TinyTest runner, a small orchestrator that discovers TinyTest binaries and runs them concurrently.
+ *
+ * Every binary named `test_*` in the test directory (by default, the directory of the runner itself) gets run
+ * in its own process, with at most `jobs` processes at once. The output of each binary is buffered and printed
+ * as a single block once it finishes, so that outputs never interleave. A merged report is printed at the end.
+ *
+ * This runner never reads from the terminal : crashes and timeouts are reported, never waited upon.
+ */
+#include <string.h>
+#include <stdio.h>
+#include <ctype.h>
+#include <errno.h>
+#include <limits.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <iostream>
+#include <chrono>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+// Same colors as the ones defined in tinytest.hpp, which is the source of truth.
+// The runner does not include tinytest.hpp, as it would redefine `assert` and expect a `new_test()`.
+#ifndef COLOR_RESET
+#define COLOR_RESET     "\033[1;0m"
+#endif
+#ifndef COLOR_GRAY
+#define COLOR_GRAY      "\033[1;90m"
+#endif
+#ifndef COLOR_GREEN
+#define COLOR_GREEN     "\033[0;32m"
+#endif
+#ifndef COLOR_GREEN_B
+#define COLOR_GREEN_B   "\033[0;92m"
+#endif
+#ifndef COLOR_RED
+#define COLOR_RED       "\033[0;91m"
+#endif
+#ifndef COLOR_YELLOW
+#define COLOR_YELLOW    "\033[1;33m"
+#endif
+#ifndef COLOR_MAGENTA
+#define COLOR_MAGENTA   "\033[1;95m"
+#endif
+
+/// @brief Prefix every test binary name should start with to be discovered.
+#define TINYTEST_RUNNER_PREFIX "test_"
+
+#ifndef TINYTEST_RESULTS_FILE_ENV
+/// @brief Environment variable through which test binaries get told where to write their results. Same as in tinytest.hpp.
+#define TINYTEST_RESULTS_FILE_ENV "TINYTEST_RESULTS_FILE"
+#endif
+
+/// @brief Timeout of a single test binary, in seconds, when none is given. 0 disables the timeout.
+#define TINYTEST_RUNNER_DEFAULT_TIMEOUT 300
+
+using tinytest_clock = std::chrono::steady_clock;
+
+/// @brief Final status of a test binary.
+enum class binary_status {
+    PASSED,
+    FAILED,
+    CRASHED,
+    TIMED_OUT,
+    INTERRUPTED,
+    NOT_STARTED
+};
+
+/// @brief Signal (SIGINT or SIGTERM) the runner received, or 0. Set by `on_interrupt_signal()`.
+static volatile sig_atomic_t TINYTEST_RUNNER_INTERRUPT_SIGNAL = 0;
+
+/// @brief Everything the runner knows about a single test binary.
+struct test_binary {
+    std::string name;
+    std::string path;
+    pid_t pid = -1;
+    int output_fd = -1;
+    std::string output;
+    /// @brief Temporary file the binary appends its machine-readable results to. Empty if it could not be created.
+    std::string results_path;
+    binary_status status = binary_status::NOT_STARTED;
+    int exit_code = 0;
+    int signal_number = 0;
+    tinytest_clock::time_point start_time;
+    std::chrono::microseconds duration {0};
+    /// @brief Test cases (flaky ones counting once) the binary reported in its results file.
+    int test_cases_run = 0;
+    /// @brief Test cases whose assertions all passed, or flaky test cases which never failed.
+    int test_cases_passed = 0;
+    /// @brief Whether a failed assertion stopped the binary (an `abort` record), which then dies from SIGABRT.
+    bool stopped_on_failed_assertion = false;
+};
+
+/// @brief Runner configuration, as read from the command line.
+struct runner_options {
+    std::string directory;
+    unsigned int jobs = 0;
+    unsigned int timeout = TINYTEST_RUNNER_DEFAULT_TIMEOUT;
+    std::vector<std::string> names;
+    std::vector<std::string> tinytest_arguments;
+};
+
+/** @cond PRIVATE */
+static void show_help(const char* program_name) {
+    std::cout << "Usage : " << program_name << " [runner-args...] [tinytest-args...] [names...]\n\n"
+        << "Runs every provided TinyTest binary concurrently, and prints a merged report.\n"
+        << "Names are test executable names, minus the '" TINYTEST_RUNNER_PREFIX "' prefix.\n"
+        << "If no name is provided, every '" TINYTEST_RUNNER_PREFIX "*' executable in the test directory is run.\n\n"
+        << "Runner arguments :\n"
+        << "- help, -h :\n\tShows this message\n"
+        << "- jobs:<n>, -j:<n> :\n\tRuns at most <n> binaries at once. Defaults to the amount of CPU cores.\n"
+        << "- timeout:<seconds>, -T:<seconds> :\n\tKills any binary running longer than <seconds>. 0 disables the timeout. Defaults to "
+            << TINYTEST_RUNNER_DEFAULT_TIMEOUT << ".\n"
+        << "- dir:<path>, -d:<path> :\n\tDirectory to look for test binaries in. Defaults to the directory of this runner.\n\n"
+        << "Any other argument starting with '-' or containing a ':', as well as the TinyTest keywords\n"
+        << "(quiet, verbose, summary, errors, important-only, ...), is passed on to each test binary.\n"
+        << "Use '-- <args...>' to pass every following argument on to each test binary."
+        << std::endl;
+}
+
+static bool starts_with(const std::string& text, const char* prefix) {
+    return text.compare(0, strlen(prefix), prefix) == 0;
+}
+
+/// @brief Parses a non-negative integer argument value. Returns false on failure.
+static bool parse_unsigned(const std::string& text, unsigned int& value) {
+    if (text.empty() || !std::all_of(text.begin(), text.end(), [](unsigned char c) { return isdigit(c) != 0; }))
+        return false;
+    errno = 0;
+    unsigned long parsed = strtoul(text.c_str(), nullptr, 10);
+    if (errno == ERANGE || parsed > UINT_MAX)
+        return false;
+    value = static_cast<unsigned int>(parsed);
+    return true;
+}
+
+/// @brief Amount of CPU cores this process may run on, honoring the affinity mask (like `nproc`).
+static unsigned int available_cpu_count() {
+#ifdef __linux__
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    if (sched_getaffinity(0, sizeof(cpu_set), &cpu_set) == 0 && CPU_COUNT(&cpu_set) > 0)
+        return static_cast<unsigned int>(CPU_COUNT(&cpu_set));
+#endif
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+/// @brief Whether the argument is one of the bare TinyTest keywords, which should be forwarded to the binaries.
+static bool is_tinytest_keyword(const std::string& argument) {
+    static const char* keywords[] = {
+        "silent", "quiet", "verbose", "summary", "shorten", "short", "errors", "error-only",
+        "important-only", "important", "show-flags", "available-flags", "flags",
+        "show-tags", "available-tags", "tags", "version"
+    };
+    for (const char* keyword : keywords)
+        if (argument == keyword)
+            return true;
+    return false;
+}
+
+/**
+ * @brief Reads the results file the binary wrote through `TINYTEST_RESULTS_FILE_ENV`, then deletes it.
+ * Records are written by `end_test_case()` and `end_flaky_test_case()` whatever the verbosity flags are,
+ * and right before a failed assertion stops execution.
+ */
+static void collect_test_case_results(test_binary& binary) {
+    if (binary.results_path.empty())
+        return;
+
+    std::ifstream results_file(binary.results_path);
+    std::string record;
+    while (std::getline(results_file, record)) {
+        int first = 0, second = 0, third = 0;
+        if (sscanf(record.c_str(), "case\t%d\t%d\t", &first, &second) == 2) {
+            binary.test_cases_run++;
+            if (first == second)
+                binary.test_cases_passed++;
+        }
+        else if (sscanf(record.c_str(), "abort\t%d\t%d\t", &first, &second) == 2) {
+            binary.test_cases_run++;
+            binary.stopped_on_failed_assertion = true;
+        }
+        else if (sscanf(record.c_str(), "flaky\t%d\t%d\t%d\t", &first, &second, &third) == 3 && first + second > 0) {
+            binary.test_cases_run++;
+            if (second == 0)
+                binary.test_cases_passed++;
+        }
+    }
+    results_file.close();
+    unlink(binary.results_path.c_str());
+    binary.results_path.clear();
+}
+
+static std::string format_duration(std::chrono::microseconds duration) {
+    long long microseconds = duration.count();
+    if (microseconds < 1'000)
+        return std::to_string(microseconds) + "µs";
+    if (microseconds < 1'000'000)
+        return std::to_string(microseconds / 1'000) + "ms";
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), "%.2fs", microseconds / 1'000'000.0);
+    return buffer;
+}
+
+static const char* status_color(binary_status status) {
+    return (status == binary_status::PASSED) ? COLOR_GREEN_B : COLOR_RED;
+}
+
+static std::string status_text(const test_binary& binary) {
+    switch (binary.status) {
+        case binary_status::PASSED:
+            return "PASSED";
+        case binary_status::FAILED:
+            if (binary.signal_number != 0)
+                return "FAILED (assertion failure stopped execution)";
+            return "FAILED (exit code " + std::to_string(binary.exit_code) + ")";
+        case binary_status::CRASHED:
+            return std::string("CRASHED (") + strsignal(binary.signal_number) + ")";
+        case binary_status::TIMED_OUT:
+            return "TIMED OUT";
+        case binary_status::INTERRUPTED:
+            return "INTERRUPTED";
+        case binary_status::NOT_STARTED:
+            return "NOT STARTED";
+    }
+    return "UNKNOWN";
+}
+
+static void on_interrupt_signal(int signal_number) {
+    TINYTEST_RUNNER_INTERRUPT_SIGNAL = signal_number;
+}
+/** @endcond */
+
+/**
+ * @brief Reads the command line arguments into the runner options.
+ * @return -1 if the runner should continue, or the exit code the runner should terminate with.
+ */
+static int parse_command_line_args(int argc, char** argv, runner_options& options) {
+    for (int i = 1; i < argc; i++) {
+        std::string argument = argv[i];
+        if (argument == "help" || argument == "--help" || argument == "-h") {
+            show_help(argv[0]);
+            return 0;
+        }
+        else if (starts_with(argument, "jobs:") || starts_with(argument, "-j:")) {
+            if (!parse_unsigned(argument.substr(argument.find(':') + 1), options.jobs) || options.jobs == 0) {
+                std::cerr << COLOR_RED << "Invalid job count : '" << argument << "'" << COLOR_RESET << std::endl;
+                return 2;
+            }
+        }
+        else if (starts_with(argument, "timeout:") || starts_with(argument, "-T:")) {
+            if (!parse_unsigned(argument.substr(argument.find(':') + 1), options.timeout)) {
+                std::cerr << COLOR_RED << "Invalid timeout : '" << argument << "'" << COLOR_RESET << std::endl;
+                return 2;
+            }
+        }
+        else if (starts_with(argument, "dir:") || starts_with(argument, "-d:")) {
+            options.directory = argument.substr(argument.find(':') + 1);
+        }
+        else if (argument == "--") {
+            for (i++; i < argc; i++)
+                options.tinytest_arguments.push_back(argv[i]);
+        }
+        else if (argument[0] == '-' || argument.find(':') != std::string::npos || is_tinytest_keyword(argument)) {
+            options.tinytest_arguments.push_back(argument);
+        }
+        else {
+            options.names.push_back(argument);
+        }
+    }
+
+    if (options.jobs == 0)
+        options.jobs = available_cpu_count();
+    if (options.directory.empty()) {
+        std::error_code error;
+        std::filesystem::path self = std::filesystem::canonical("/proc/self/exe", error);
+        options.directory = error ? std::filesystem::path(argv[0]).parent_path().string() : self.parent_path().string();
+        if (options.directory.empty())
+            options.directory = ".";
+    }
+    return -1;
+}
+
+/// @brief Finds the test binaries to run, either from the given names, or from the test directory.
+static std::vector<test_binary> discover_binaries(const runner_options& options) {
+    std::vector<test_binary> binaries;
+    std::filesystem::path directory = options.directory;
+
+    if (!options.names.empty()) {
+        for (const std::string& name : options.names) {
+            test_binary binary;
+            binary.name = name;
+            binary.path = (directory / (TINYTEST_RUNNER_PREFIX + name)).string();
+            binaries.push_back(binary);
+        }
+        return binaries;
+    }
+
+    std::error_code error;
+    for (const auto& entry : std::filesystem::directory_iterator(directory, error)) {
+        std::string file_name = entry.path().filename().string();
+        if (!starts_with(file_name, TINYTEST_RUNNER_PREFIX) || !entry.is_regular_file())
+            continue;
+        if (access(entry.path().c_str(), X_OK) != 0)
+            continue;
+        test_binary binary;
+        binary.name = file_name.substr(strlen(TINYTEST_RUNNER_PREFIX));
+        binary.path = entry.path().string();
+        binaries.push_back(binary);
+    }
+    std::sort(binaries.begin(), binaries.end(), [](const test_binary& a, const test_binary& b) { return a.name < b.name; });
+    return binaries;
+}
+
+/**
+ * @brief Starts the given binary in a new process, with its stdout and stderr redirected to a pipe.
+ * @return Whether the process could be started.
+ */
+static bool start_binary(test_binary& binary, const std::vector<std::string>& tinytest_arguments) {
+    int pipe_fds[2];
+    if (pipe(pipe_fds) != 0) {
+        binary.output = std::string("Could not create pipe : ") + strerror(errno) + "\n";
+        return false;
+    }
+
+    std::vector<char*> child_argv;
+    child_argv.push_back(const_cast<char*>(binary.path.c_str()));
+    for (const std::string& argument : tinytest_arguments)
+        child_argv.push_back(const_cast<char*>(argument.c_str()));
+    child_argv.push_back(nullptr);
+
+    const char* temporary_directory = getenv("TMPDIR");
+    std::string results_template = std::string((temporary_directory && *temporary_directory) ? temporary_directory : "/tmp")
+        + "/tinytest_results_XXXXXX";
+    int results_fd = mkstemp(&results_template[0]);
+    if (results_fd >= 0) {
+        close(results_fd);
+        binary.results_path = results_template;
+    }
+
+    binary.start_time = tinytest_clock::now();
+    pid_t pid = fork();
+    if (pid < 0) {
+        binary.output = std::string("Could not fork : ") + strerror(errno) + "\n";
+        close(pipe_fds[0]);
+        close(pipe_fds[1]);
+        collect_test_case_results(binary);
+        return false;
+    }
+    if (pid == 0) {
+        // Own process group, so a timeout also takes down anything the test spawned
+        setpgid(0, 0);
+        int null_fd = open("/dev/null", O_RDONLY);
+        if (null_fd >= 0) {
+            dup2(null_fd, STDIN_FILENO);
+            if (null_fd != STDIN_FILENO)
+                close(null_fd);
+        }
+        dup2(pipe_fds[1], STDOUT_FILENO);
+        dup2(pipe_fds[1], STDERR_FILENO);
+        close(pipe_fds[0]);
+        close(pipe_fds[1]);
+        // Ignored signals survive exec, so the test binary gets the default SIGPIPE behaviour back
+        signal(SIGPIPE, SIG_DFL);
+        if (!binary.results_path.empty())
+            setenv(TINYTEST_RESULTS_FILE_ENV, binary.results_path.c_str(), 1);
+        execv(binary.path.c_str(), child_argv.data());
+        fprintf(stderr, "Could not execute '%s' : %s\n", binary.path.c_str(), strerror(errno));
+        _exit(127);
+    }
+
+    setpgid(pid, pid);
+    close(pipe_fds[1]);
+    fcntl(pipe_fds[0], F_SETFL, fcntl(pipe_fds[0], F_GETFL) | O_NONBLOCK);
+    fcntl(pipe_fds[0], F_SETFD, FD_CLOEXEC);
+    binary.pid = pid;
+    binary.output_fd = pipe_fds[0];
+    return true;
+}
+
+/// @brief Reads whatever is available on the binary's pipe. Closes the pipe on end of file.
+static void drain_output(test_binary& binary) {
+    char buffer[4096];
+    while (binary.output_fd >= 0) {
+        ssize_t bytes_read = read(binary.output_fd, buffer, sizeof(buffer));
+        if (bytes_read > 0) {
+            binary.output.append(buffer, bytes_read);
+        }
+        else if (bytes_read < 0 && errno == EINTR) {
+            continue;
+        }
+        else {
+            if (bytes_read == 0 || (errno != EAGAIN && errno != EWOULDBLOCK)) {
+                close(binary.output_fd);
+                binary.output_fd = -1;
+            }
+            return;
+        }
+    }
+}
+
+/// @brief Prints the buffered output and status of a finished binary, as a single block.
+static void print_binary_block(const test_binary& binary) {
+    std::cout << COLOR_GREEN << "Running tests of project '" << COLOR_YELLOW << binary.name << COLOR_GREEN << "'" << COLOR_RESET << "\n"
+        << binary.output;
+    if (!binary.output.empty() && binary.output.back() != '\n')
+        std::cout << "\n";
+    std::cout << COLOR_GRAY << "Project '" << binary.name << "' : " << status_color(binary.status) << status_text(binary)
+        << COLOR_GRAY << " in " << COLOR_MAGENTA << format_duration(binary.duration) << COLOR_RESET << "\n" << std::endl;
+}
+
+/// @brief Prints the merged report of every binary, and returns whether they all passed.
+static bool print_report(const std::vector<test_binary>& binaries, std::chrono::microseconds total_duration, unsigned int jobs) {
+    int binaries_passed = 0, test_cases_run = 0, test_cases_passed = 0;
+    size_t name_width = 0;
+    for (const test_binary& binary : binaries)
+        name_width = std::max(name_width, binary.name.size());
+
+    std::cout << COLOR_GRAY << "------------ TinyTest Runner Report ------------" << COLOR_RESET << "\n";
+    for (const test_binary& binary : binaries) {
+        if (binary.status == binary_status::PASSED)
+            binaries_passed++;
+        test_cases_run += binary.test_cases_run;
+        test_cases_passed += binary.test_cases_passed;
+
+        std::cout << "  " << binary.name << std::string(name_width - binary.name.size(), ' ') << "  "
+            << status_color(binary.status) << status_text(binary) << COLOR_GRAY << " - " << format_duration(binary.duration);
+        if (binary.test_cases_run > 0)
+            std::cout << " - " << binary.test_cases_passed << "/" << binary.test_cases_run << " test cases passed";
+        std::cout << COLOR_RESET << "\n";
+    }
+
+    bool all_passed = binaries_passed == static_cast<int>(binaries.size());
+    std::cout << COLOR_GRAY << " -> " << (all_passed ? COLOR_GREEN_B : COLOR_RED) << binaries_passed << "/" << binaries.size()
+        << COLOR_GRAY << " projects passed";
+    if (test_cases_run > 0)
+        std::cout << ", " << test_cases_passed << "/" << test_cases_run << " test cases passed";
+    std::cout << ", in " << COLOR_MAGENTA << format_duration(total_duration) << COLOR_GRAY
+        << " (" << jobs << " job" << (jobs > 1 ? "s" : "") << ")." << COLOR_RESET << std::endl;
+    return all_passed;
+}
+
+int main(int argc, char** argv) {
+    runner_options options;
+    int early_exit_code = parse_command_line_args(argc, argv, options);
+    if (early_exit_code >= 0)
+        return early_exit_code;
+
+    std::vector<test_binary> binaries = discover_binaries(options);
+    if (binaries.empty()) {
+        std::cerr << COLOR_RED << "No test executable name to test provided, and none in test folder '"
+            << options.directory << "'." << COLOR_RESET << std::endl;
+        return 1;
+    }
+
+    // A test binary dying mid-write should not take the runner down with it
+    signal(SIGPIPE, SIG_IGN);
+    // Test binaries live in their own process groups, so they have to be killed by hand when the runner is cancelled
+    struct sigaction interrupt_action = {};
+    interrupt_action.sa_handler = on_interrupt_signal;
+    sigemptyset(&interrupt_action.sa_mask);
+    sigaction(SIGINT, &interrupt_action, nullptr);
+    sigaction(SIGTERM, &interrupt_action, nullptr);
+
+    const tinytest_clock::time_point runner_start = tinytest_clock::now();
+    const auto timeout = std::chrono::seconds(options.timeout);
+    size_t next_binary = 0;
+    std::vector<test_binary*> running;
+
+    while ((next_binary < binaries.size() || !running.empty()) && !TINYTEST_RUNNER_INTERRUPT_SIGNAL) {
+        // Fills every free job slot
+        while (running.size() < options.jobs && next_binary < binaries.size()) {
+            test_binary& binary = binaries[next_binary++];
+            if (start_binary(binary, options.tinytest_arguments)) {
+                running.push_back(&binary);
+            }
+            else {
+                binary.status = binary_status::NOT_STARTED;
+                print_binary_block(binary);
+            }
+        }
+
+        // Waits for output from any running binary, waking up regularly to check for exits and timeouts
+        std::vector<pollfd> poll_fds;
+        for (test_binary* binary : running)
+            if (binary->output_fd >= 0)
+                poll_fds.push_back({binary->output_fd, POLLIN, 0});
+        if (!poll_fds.empty())
+            poll(poll_fds.data(), poll_fds.size(), 50);
+        else
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+        for (auto it = running.begin(); it != running.end();) {
+            test_binary& binary = **it;
+            drain_output(binary);
+
+            if (options.timeout > 0 && binary.status != binary_status::TIMED_OUT &&
+                    tinytest_clock::now() - binary.start_time > timeout) {
+                kill(-binary.pid, SIGKILL);
+                binary.status = binary_status::TIMED_OUT;
+            }
+
+            int wait_status = 0;
+            pid_t result = waitpid(binary.pid, &wait_status, WNOHANG);
+            if (result == 0 || (result < 0 && errno == EINTR)) {
+                ++it;
+                continue;
+            }
+
+            // Gets whatever remains in the pipe ; grandchildren may keep it open, so the read stays non-blocking
+            drain_output(binary);
+            if (binary.output_fd >= 0) {
+                close(binary.output_fd);
+                binary.output_fd = -1;
+            }
+            binary.duration = std::chrono::duration_cast<std::chrono::microseconds>(tinytest_clock::now() - binary.start_time);
+            collect_test_case_results(binary);
+            if (binary.status != binary_status::TIMED_OUT) {
+                if (result > 0 && WIFSIGNALED(wait_status)) {
+                    binary.signal_number = WTERMSIG(wait_status);
+                    // TINYTEST_ASSERTION_FAILED_STOPS_EXECUTION aborts on purpose : that's a failure, not a crash
+                    bool stopped_by_assertion = binary.stopped_on_failed_assertion && binary.signal_number == SIGABRT;
+                    binary.status = stopped_by_assertion ? binary_status::FAILED : binary_status::CRASHED;
+                }
+                else {
+                    binary.exit_code = (result > 0 && WIFEXITED(wait_status)) ? WEXITSTATUS(wait_status) : -1;
+                    binary.status = (binary.exit_code == 0) ? binary_status::PASSED : binary_status::FAILED;
+                }
+            }
+            print_binary_block(binary);
+            it = running.erase(it);
+        }
+    }
+
+    if (TINYTEST_RUNNER_INTERRUPT_SIGNAL) {
+        for (test_binary* binary : running) {
+            kill(-binary->pid, SIGKILL);
+            while (waitpid(binary->pid, nullptr, 0) < 0 && errno == EINTR);
+            drain_output(*binary);
+            if (binary->output_fd >= 0) {
+                close(binary->output_fd);
+                binary->output_fd = -1;
+            }
+            binary->duration = std::chrono::duration_cast<std::chrono::microseconds>(tinytest_clock::now() - binary->start_time);
+            binary->status = binary_status::INTERRUPTED;
+            collect_test_case_results(*binary);
+            print_binary_block(*binary);
+        }
+        std::cerr << COLOR_RED << "Runner interrupted by " << strsignal(TINYTEST_RUNNER_INTERRUPT_SIGNAL)
+            << ", running tests were killed." << COLOR_RESET << std::endl;
+    }
+
+    auto total_duration = std::chrono::duration_cast<std::chrono::microseconds>(tinytest_clock::now() - runner_start);
+    bool all_passed = print_report(binaries, total_duration, options.jobs);
+    if (TINYTEST_RUNNER_INTERRUPT_SIGNAL)
+        return 128 + TINYTEST_RUNNER_INTERRUPT_SIGNAL;
+    return all_passed ? 0 : 1;
+}
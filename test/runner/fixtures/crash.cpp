@@ -0,0 +1,15 @@
+#include <tinytest.hpp>
+#include <cstdlib>
+
+// Runner fixture : one test case passes, then the program aborts.
+new_test() {
+    handle_command_line_args();
+
+    new_test_case("Passing test case");
+        test_assert("1 + 1 == 2 ?", 1 + 1 == 2);
+    end_test_case();
+
+    std::abort();
+
+    end_of_all_tests();
+}
@@ -0,0 +1,13 @@
+#include <tinytest.hpp>
+#include <thread>
+
+// Runner fixture : never finishes on its own.
+new_test() {
+    handle_command_line_args();
+
+    new_test_case("Hanging test case");
+        std::this_thread::sleep_for(std::chrono::minutes(10));
+    end_test_case();
+
+    end_of_all_tests();
+}
@@ -0,0 +1,27 @@
+#define TINYTEST_FLAKY_TEST_ITERATIONS 3
+#include <tinytest.hpp>
+
+// Runner fixture : every test case passes.
+new_test() {
+    handle_command_line_args();
+
+    // Lets the runner tests check which arguments got passed on
+    for (int i = 1; i < argc; i++)
+        std::cout << "Received argument: " << argv[i] << std::endl;
+
+    new_test_case("Passing test case");
+        test_assert("1 + 1 == 2 ?", 1 + 1 == 2);
+        // Looks like a test case summary, but should not be counted by the runner
+        std::cout << " -> 0/9 tests passed." << std::endl;
+    end_test_case();
+
+    new_test_case("Another passing test case");
+        test_assert("2 * 2 == 4 ?", 2 * 2 == 4);
+    end_test_case();
+
+    new_flaky_test_case("Passing flaky test case");
+        test_assert("true ?", true);
+    end_flaky_test_case();
+
+    end_of_all_tests();
+}
@@ -0,0 +1,16 @@
+#include <tinytest.hpp>
+
+// Runner fixture : default settings, so the failing assertion stops execution.
+new_test() {
+    handle_command_line_args();
+
+    new_test_case("Passing test case");
+        test_assert("1 + 1 == 2 ?", 1 + 1 == 2);
+    end_test_case();
+
+    new_test_case("Failing test case");
+        test_assert("1 + 1 == 3 ?", 1 + 1 == 3);
+    end_test_case();
+
+    end_of_all_tests();
+}
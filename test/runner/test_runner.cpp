@@ -0,0 +1,136 @@
+#define TINYTEST_ASSERTION_FAILED_STOPS_EXECUTION 0
+#include <tinytest.hpp>
+
+#include <stdio.h>
+#include <sys/wait.h>
+
+// TINYTEST_RUNNER_PATH and TINYTEST_RUNNER_FIXTURES_DIR are defined by CMake.
+
+/// @brief Runs a shell command, storing its standard output and error. Returns its exit code.
+static int run_command(const std::string& command, std::string& output) {
+    output.clear();
+    FILE* pipe = popen(("{ " + command + "; } 2>&1").c_str(), "r");
+    if (pipe == nullptr)
+        return -1;
+    char buffer[4096];
+    size_t bytes_read;
+    while ((bytes_read = fread(buffer, 1, sizeof(buffer), pipe)) > 0)
+        output.append(buffer, bytes_read);
+    int status = pclose(pipe);
+    return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+}
+
+/// @brief Runs the TinyTest runner against the fixtures directory, with the given arguments.
+static int run_runner(const std::string& arguments, std::string& output) {
+    return run_command("'" TINYTEST_RUNNER_PATH "' 'dir:" TINYTEST_RUNNER_FIXTURES_DIR "' " + arguments, output);
+}
+
+/// @brief Finds the line of the runner report about the given project, without its colors.
+static std::string report_line(const std::string& output, const std::string& name) {
+    std::stringstream lines(output);
+    std::string line;
+    while (std::getline(lines, line)) {
+        if (line.compare(0, name.size() + 3, "  " + name + " ") != 0)
+            continue;
+        std::string plain_line;
+        for (size_t i = 0; i < line.size(); i++) {
+            if (line[i] == '\033')
+                while (i < line.size() && line[i] != 'm') i++;
+            else
+                plain_line += line[i];
+        }
+        return plain_line;
+    }
+    return "";
+}
+
+static bool contains(const std::string& text, const std::string& part) {
+    return text.find(part) != std::string::npos;
+}
+
+
+new_test() {
+    handle_command_line_args();
+
+    new_test_case("Passing binary");
+        std::string output;
+        int exit_code = run_runner("pass", output);
+        test_assert_var("Runner exits with 0 ?", exit_code, ==, 0);
+        test_assert_pro("Binary is reported as passed ?", contains(report_line(output, "pass"), "PASSED"), output);
+        test_assert_pro("Flaky test case counts once, printed summaries are ignored ?",
+            contains(report_line(output, "pass"), "3/3 test cases passed"), output);
+    end_test_case();
+
+    new_test_case("Test case results are read whatever the verbosity");
+        std::string output;
+        int exit_code = run_runner("-q pass fail", output);
+        test_assert_var("Runner exits with 1 ?", exit_code, ==, 1);
+        test_assert_pro("Counts are there with -q ?", contains(report_line(output, "pass"), "3/3 test cases passed"), output);
+        test_assert_pro("Failing binary counts are there with -q ?", contains(report_line(output, "fail"), "1/2 test cases passed"), output);
+
+        exit_code = run_runner("-e fail", output);
+        test_assert_pro("Counts are there with -e ?", contains(report_line(output, "fail"), "1/2 test cases passed"), output);
+    end_test_case();
+
+    new_test_case("Failed assertion stopping execution");
+        std::string output;
+        int exit_code = run_runner("stop", output);
+        test_assert_var("Runner exits with 1 ?", exit_code, ==, 1);
+        test_assert_pro("Reported as a failure, not a crash ?", contains(report_line(output, "stop"), "FAILED (assertion failure stopped execution)"), output);
+        test_assert_pro("Stopped test case is counted as failed ?", contains(report_line(output, "stop"), "1/2 test cases passed"), output);
+    end_test_case();
+
+    new_test_case("Pass, fail, crash and hang");
+        std::string output;
+        int exit_code = run_runner("-T:1 -j:4", output);
+        test_assert_var("Runner exits with 1 ?", exit_code, ==, 1);
+        test_assert_pro("Passing binary ?", contains(report_line(output, "pass"), "PASSED"), output);
+        test_assert_pro("Failing binary ?", contains(report_line(output, "fail"), "FAILED (exit code 1)"), output);
+        test_assert_pro("Crashing binary ?", contains(report_line(output, "crash"), "CRASHED ("), output);
+        test_assert_pro("Results written before the crash are kept ?", contains(report_line(output, "crash"), "1/1 test cases passed"), output);
+        test_assert_pro("Hanging binary ?", contains(report_line(output, "hang"), "TIMED OUT"), output);
+        test_assert_pro("Merged report ?", contains(output, "1/5") && contains(output, "projects passed"), output);
+    end_test_case();
+
+    new_test_case("Argument handling");
+        std::string output;
+        int exit_code = run_runner("pass -- fail", output);
+        test_assert_var("Arguments after -- are passed on, not run ?", exit_code, ==, 0);
+        test_assert_pro("Only one project ran ?", report_line(output, "fail").empty() && contains(output, "1/1"), output);
+        test_assert_pro("Binary received the argument ?", contains(output, "Received argument: fail"), output);
+
+        exit_code = run_runner("pass quiet tag:Nothing", output);
+        test_assert_var("Keywords and ':' arguments are passed on ?", exit_code, ==, 0);
+        test_assert_pro("Binary received both arguments ?",
+            contains(output, "Received argument: quiet") && contains(output, "Received argument: tag:Nothing"), output);
+        test_assert_pro("Forwarded tag skipped every test case ?",
+            !report_line(output, "pass").empty() && !contains(report_line(output, "pass"), "test cases passed"), output);
+
+        exit_code = run_runner("pass missing", output);
+        test_assert_var("Missing binary fails the run ?", exit_code, ==, 1);
+        test_assert_pro("Missing binary is reported ?", contains(report_line(output, "missing"), "FAILED (exit code 127)"), output);
+
+        exit_code = run_runner("jobs:99999999999999999999 pass", output);
+        test_assert_var("Out of range job count is rejected ?", exit_code, ==, 2);
+        test_assert_pro("Out of range job count message ?", contains(output, "Invalid job count"), output);
+
+        exit_code = run_runner("-j:0 pass", output);
+        test_assert_var("Zero job count is rejected ?", exit_code, ==, 2);
+
+        exit_code = run_runner("-T:4294967296 pass", output);
+        test_assert_var("Out of range timeout is rejected ?", exit_code, ==, 2);
+        test_assert_pro("Out of range timeout message ?", contains(output, "Invalid timeout"), output);
+    end_test_case();
+
+    new_test_case("Interrupted runner");
+        std::string output;
+        int exit_code = run_command(
+            "'" TINYTEST_RUNNER_PATH "' 'dir:" TINYTEST_RUNNER_FIXTURES_DIR "' hang & RUNNER_PID=$!; sleep 1; kill -TERM $RUNNER_PID; wait $RUNNER_PID",
+            output
+        );
+        test_assert_var("Runner exits with 128 + SIGTERM ?", exit_code, ==, 128 + SIGTERM);
+        test_assert_pro("Running binary is reported as interrupted ?", contains(report_line(output, "hang"), "INTERRUPTED"), output);
+    end_test_case();
+
+    end_of_all_tests();
+}